@@ -8,3 +8,4 @@ fi
 cd simpleFoamMVStateProductReverse && wclean && rm log && cd - || exit 1
 cd simpleFoamMVPointProductReverse && wclean && rm log && cd - || exit 1
 cd run && rm *.txt && cd - || exit 1
+rm -rf run/simple run/newton || exit 1
@@ -0,0 +1,30 @@
+#!/usr/bin/env bash
+
+# Convergence check of DASimpleFoamNewtonKrylovForwardAD (ADF build):
+# SIMPLE iterations alone and a few SIMPLE iterations followed by the
+# Newton-Krylov iterations must reach the same steady state
+
+if [ -z "$WM_PROJECT" ]; then
+  echo "OpenFOAM environment not found, forgot to source the OpenFOAM bashrc?"
+  exit 1
+fi
+
+if [ "$WM_CODI_AD_LIB_POSTFIX" != "ADF" ]; then
+  echo "DASimpleFoamNewtonKrylovForwardAD needs the forward-mode (ADF) build"
+  exit 1
+fi
+
+for case in simple newton; do
+  rm -rf run/$case
+  mkdir run/$case || exit 1
+  cp -r run/0.orig run/$case/0 && cp -r run/constant run/system run/$case || exit 1
+done
+
+foamDictionary run/simple/system/controlDict -entry endTime -set 5000 > /dev/null || exit 1
+foamDictionary run/simple/system/controlDict -entry writeInterval -set 5000 > /dev/null || exit 1
+foamDictionary run/newton/system/controlDict -entry writeInterval -set 1000 > /dev/null || exit 1
+
+DASimpleFoamNewtonKrylovForwardAD -case run/simple -nSimpleIter 5000 -maxNewtonIter 0 > run/simple/log || exit 1
+DASimpleFoamNewtonKrylovForwardAD -case run/newton -nSimpleIter 100 -maxNewtonIter 30 -newtonTol 1e-10 > run/newton/log || exit 1
+
+cd run && python checkNewtonKrylov.py simple newton && cd - || exit 1
@@ -0,0 +1,70 @@
+"""
+Convergence check of the Jacobian-free Newton-Krylov solver
+The steady states reached by SIMPLE alone and by the Newton-Krylov
+iterations must agree
+"""
+
+import gzip
+import os
+import re
+import sys
+
+import numpy as np
+from numpy import linalg as LA
+
+simpleCase = sys.argv[1]
+newtonCase = sys.argv[2]
+
+tol = 1e-4
+
+
+def latestTime(case):
+    times = []
+    for name in os.listdir(case):
+        try:
+            times.append((float(name), name))
+        except ValueError:
+            pass
+    return max(times)[1]
+
+
+def readInternalField(case, fieldName):
+    path = os.path.join(case, latestTime(case), fieldName)
+    if os.path.exists(path + ".gz"):
+        f = gzip.open(path + ".gz", "rt")
+    else:
+        f = open(path, "r")
+    text = f.read()
+    f.close()
+
+    match = re.search(
+        r"internalField\s+nonuniform\s+List<\w+>\s*\d+\s*\((.*?)\)\s*;",
+        text,
+        re.S,
+    )
+    values = match.group(1).replace("(", " ").replace(")", " ").split()
+    return np.asarray([float(v) for v in values])
+
+
+failed = False
+
+for fieldName in ["U", "p"]:
+    simpleField = readInternalField(simpleCase, fieldName)
+    newtonField = readInternalField(newtonCase, fieldName)
+
+    diff = LA.norm(newtonField - simpleField) / LA.norm(simpleField)
+
+    print("Relative difference in %s: %g" % (fieldName, diff))
+
+    if diff > tol:
+        failed = True
+
+if failed:
+    print("\n**********************************************")
+    print("Test Failed!!!!!! Relative difference > %g" % tol)
+    print("**********************************************")
+    exit(1)
+else:
+    print("\n**********************************************")
+    print("Test Passed!")
+    print("**********************************************")